@@ -32,6 +32,7 @@ using YYLTYPE = struct YYLTYPE {
 #include <hobbes/lang/typepreds.H>
 #include <hobbes/parse/grammar.H>
 #include <hobbes/parse/lalr.H>
+#include <hobbes/parse/stream.H>
 #include <hobbes/read/pgen/hexpr.parse.H>
 #include <hobbes/util/array.H>
 #include <hobbes/util/autorelease.H>
@@ -713,6 +714,19 @@ l5expr: l6expr { $$ = $1; }
           throw annotated_error(m(@1,@4), ss.str());
         }
       }
+      | "parse" id "{" prules "}" {
+        if (*$2 != "stream") {
+          throw annotated_error(m(@1,@2), "Unknown parser kind '" + *$2 + "' (only 'parse stream {...}' is supported)");
+        }
+        try {
+          $$ = makeStreamParser(yyParseCC, *$4, m(@1,@5))->clone();
+        } catch (hobbes::compile_table_failure& ctf) {
+          std::ostringstream ss;
+          ss << ctf.what() << std::endl;
+          ctf.print(ss);
+          throw annotated_error(m(@1,@5), ss.str());
+        }
+      }
 
       /* action sequence */
       | "do" "{" dobindings "}"                 { $$ = compileNestedLetMatch(*$3, ExprPtr(new Unit(m(@1,@4))), m(@1,@4)); }
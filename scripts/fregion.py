@@ -37,6 +37,12 @@
 #          def read(self, m, offset):
 #            pass
 #
+#    If the compiled 'fregion_ext' module can be imported, stored series can be read through it (much faster):
+#      f = fregion.FRegion(P, native=True)
+#    but values read this way are decoded eagerly into plain python values (records are named tuples, variants
+#    are (cn, value) named tuples, enums are constructor names and arrays are lists) rather than the lazy views
+#    produced by the pure python decoders here, so native decoding must be requested explicitly
+#
 ########################################################
 
 import os
@@ -46,6 +52,13 @@ import math
 import datetime
 import uuid
 import base64
+import bisect
+
+# the optional native decoder for stored series (built from fregion_ext.C)
+try:
+  import fregion_ext
+except ImportError:
+  fregion_ext = None
 
 #######
 #
@@ -290,7 +303,7 @@ def freeVarsInto(m,ty):
     "variant": lambda v:  [freeVarsInto(m,ctor[2]) for ctor in v.ctors],
     "struct":  lambda s:  [freeVarsInto(m,field[2]) for field in s.fields],
     "long":    lambda n:  None,
-    "app":     lambda a:  (freeVarsInto(m,a.f), [freeVarsInto(m,arg) for arg in f.args]),
+    "app":     lambda a:  (freeVarsInto(m,a.f), [freeVarsInto(m,arg) for arg in a.args]),
     "rec":     lambda r:  m.update(dictWithout(freeVars(r.ty),r.vn)),
     "abs":     lambda a:  m.update(dictWithouts(freeVars(a.ty),a.vns))
   }
@@ -1061,8 +1074,9 @@ def tableFormat(cs):
   return s
 
 class FRegion:
-  def __init__(self, fpath):
-    self.rep = FREnvelope(fpath)
+  def __init__(self, fpath, native=False):
+    self.rep    = FREnvelope(fpath)
+    self.native = native and fregion_ext != None
 
     for vn, bind in self.rep.env.items():
       bind.reader = makeReader({}, bind.ty)
@@ -1087,6 +1101,11 @@ class FRegion:
     b = self.rep.env.get(attr, None)
     if (b == None):
       raise Exception("FRegion has no field named '" + attr + "'")
+    elif (self.native and isinstance(b.reader, FSeqReader) and nativeDecodable(b.ty)):
+      try:
+        return NativeStream(fregion_ext.Series(self.rep.p, attr))
+      except TypeError:
+        return b.reader.read(self.rep.m, b.offset)
     else:
       return b.reader.read(self.rep.m, b.offset)
 
@@ -1206,6 +1225,65 @@ class SLMapReader:
   def read(self,m,offset):
     return SLView(self.sr.read(m,offset))
 
+# B+-tree maps (e.g. secondary indexes over stored series)
+class BPTView:
+  def __init__(self,bt):
+    self.bt=bt
+
+  # the leaf and position of the first entry with a key not less than k (or the first entry if k is None)
+  # (each inner node holds the least key in each of its children)
+  def seek(self,k):
+    n=self.bt.root
+    while (n.cn == "node"):
+      c=0 if k==None else max(bisect.bisect_left(n.value.keys,k)-1,0)
+      n=n.value.children[c]
+    return (n.value, 0 if k==None else bisect.bisect_left(n.value.keys,k))
+
+  # the (key,value) entries from a key up to a key (or to the end if hi is None)
+  def entries(self,lo,hi):
+    l,i=self.seek(lo)
+    while (not(l==None)):
+      ks=l.keys
+      while (i < len(ks)):
+        if (not(hi==None) and ks[i] > hi):
+          return
+        yield (ks[i], l.values[i])
+        i=i+1
+      n=l.next
+      l=None if n==None else n.value
+      i=0
+
+  def range(self,lo,hi):
+    return list(self.entries(lo,hi))
+
+  # the values with a key, in insertion order
+  def __getitem__(self,k):
+    return [v for _,v in self.entries(k,k)]
+  def __contains__(self,k):
+    for _ in self.entries(k,k):
+      return True
+    return False
+  def __iter__(self):
+    return self.entries(None,None)
+  def __len__(self): return self.bt.count
+  def __str__(self): return self.__repr__()
+  def __repr__(self):
+    ks=[]
+    eqs=[]
+    vs=[]
+    for k,v in self.entries(None,None):
+      ks.append(str(k))
+      eqs.append(' = ')
+      vs.append(str(v))
+    return tableFormat([ks,eqs,vs])
+
+@RegReader("bptree")
+class BPTreeReader:
+  def __init__(self,renv,ty,repty):
+    self.br = makeReader(renv, repty)
+  def read(self,m,offset):
+    return BPTView(self.br.read(m,offset))
+
 #uuid
 class HobUUID(uuid.UUID):
   def __init__(self, *args, **kwargs):
@@ -1281,3 +1359,70 @@ class FSeqReader:
   def read(self, m, o):
     return RecStream(self.rr.read(m,o))
 
+#######
+#
+# Stored sequences read through the native decoder
+#
+#######
+
+# the native decoder can't apply custom readers, so a series can only be decoded natively if its type doesn't need any
+nativeTypeExts = ["fseq", "fileref", "carray", "datetime"]
+
+def customTypeNamesInto(m, ty):
+  tyDisp = {
+    "prim":    lambda p:  (m.update({p.name:None}) if p.name in globalTypeExts else None, customTypeNamesInto(m,p.rep) if p.rep != None else None),
+    "var":     lambda v:  None,
+    "farr":    lambda fa: customTypeNamesInto(m,fa.ty),
+    "arr":     lambda a:  customTypeNamesInto(m,a.ty),
+    "variant": lambda v:  [customTypeNamesInto(m,ctor[2]) for ctor in v.ctors],
+    "struct":  lambda s:  [customTypeNamesInto(m,field[2]) for field in s.fields],
+    "long":    lambda n:  None,
+    "app":     lambda a:  (customTypeNamesInto(m,a.f), [customTypeNamesInto(m,arg) for arg in a.args]),
+    "rec":     lambda r:  customTypeNamesInto(m,r.ty),
+    "abs":     lambda a:  customTypeNamesInto(m,a.ty)
+  }
+  return TyCase(tyDisp).apply(ty)
+
+def nativeDecodable(ty):
+  m={}
+  customTypeNamesInto(m,ty)
+  return all(map(lambda n: n in nativeTypeExts, m.keys()))
+
+class NativeStream:
+  def __init__(self, s):
+    self.s = s
+
+  def iter(self):
+    return iter(self.s)
+
+  def __iter__(self):
+    return iter(self.s)
+
+  def __len__(self):
+    return len(self.s)
+
+  def __str__(self):
+    sz = 0
+    content = ""
+    for v in self.s:
+      sz += 1
+      if sz > 10:
+        content += "... ... ..."
+        break
+      content += "{}. {}\n".format(sz, v)
+    return content
+
+  def __getitem__(self, i):
+    return self.s[i]
+
+  # memoryviews over stored batches (values in each are 'stride' bytes apart, and can be unpacked with 'format')
+  def batches(self):
+    return self.s.batches()
+
+  @property
+  def stride(self):
+    return self.s.stride
+
+  @property
+  def format(self):
+    return self.s.format
@@ -0,0 +1,71 @@
+#!/usr/bin/env python
+
+########################################################
+#
+# fregion_bench.py : compare rows/sec reading stored series with the pure python and native decoders
+#
+#    python fregion_bench.py P [series ...]
+#
+#    every value in each series (all series in the file at P, by default) is fully decoded by both readers
+#    (the native reader decodes values completely as it reads them), and the two must read the same number of values
+#
+########################################################
+
+import sys
+import time
+import fregion
+
+# decode everything in a value (the pure python reader defers reading record fields and variant payloads)
+def force(v):
+  if (isinstance(v, fregion.StructView)):
+    return [force(x.value) for x in v.vs]
+  elif (isinstance(v, fregion.VariantView)):
+    return (v.cn, force(v.value))
+  elif (isinstance(v, fregion.ArrReaderGenerator)):
+    return [force(x) for x in v()]
+  elif (isinstance(v, (list, tuple))):
+    return [force(x) for x in v]
+  else:
+    return v
+
+def readAll(s, native):
+  n = 0
+  if (native):
+    for v in s.iter():
+      n += 1
+  else:
+    for v in s.iter():
+      force(v)
+      n += 1
+  return n
+
+def timed(f, sn):
+  t0 = time.time()
+  n  = readAll(getattr(f, sn), f.native)
+  return (n, max(time.time() - t0, 1e-9))
+
+def main(argv):
+  if (len(argv) < 2):
+    print("usage: " + argv[0] + " <file> [series ...]")
+    return 1
+
+  pf = fregion.FRegion(argv[1], native=False)
+  nf = fregion.FRegion(argv[1], native=True)
+  sns = argv[2:]
+  if (len(sns) == 0):
+    sns = sorted([vn for vn, b in pf.rep.env.items() if isinstance(b.reader, fregion.FSeqReader)])
+
+  if (not nf.native):
+    print("warning: the native decoder (fregion_ext) isn't available, so both paths are pure python")
+
+  for sn in sns:
+    pn, pt = timed(pf, sn)
+    nn, nt = timed(nf, sn)
+    if (pn != nn):
+      print(sn + ": pure python read " + str(pn) + " values but native read " + str(nn))
+      return 1
+    print("%s: %d values, pure python %.0f rows/sec, native %.0f rows/sec (%.1fx)" % (sn, pn, pn / pt, nn / nt, pt / nt))
+  return 0
+
+if __name__ == "__main__":
+  sys.exit(main(sys.argv))